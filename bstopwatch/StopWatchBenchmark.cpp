@@ -0,0 +1,158 @@
+/*
+ * Copyright 2026, Haiku, Inc. All Rights Reserved.
+ * Distributed under the terms of the MIT License.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <OS.h>
+#include <StopWatch.h>
+
+
+static const int32 kThreadCount = 64;
+
+static volatile bigtime_t sSink;
+static int64 sThreadSink;
+
+
+static void
+report(const char* name, int32 iterations, bigtime_t elapsed)
+{
+	printf("%-28s %10" B_PRId32 " ops %10.1f ns/op\n", name, iterations,
+		elapsed * 1000.0 / iterations);
+}
+
+
+static void
+benchmark_calls(int32 iterations)
+{
+	bigtime_t start = system_time();
+	for (int32 i = 0; i < iterations; i++)
+		sSink += system_time();
+	report("system_time()", iterations, system_time() - start);
+
+	start = system_time();
+	for (int32 i = 0; i < iterations; i++) {
+		BStopWatch watch("benchmark", true);
+		sSink += watch.ElapsedTime();
+	}
+	report("construct + destruct", iterations, system_time() - start);
+
+	BStopWatch watch("benchmark", true);
+
+	start = system_time();
+	for (int32 i = 0; i < iterations; i++)
+		sSink += watch.ElapsedTime();
+	report("ElapsedTime()", iterations, system_time() - start);
+
+	start = system_time();
+	for (int32 i = 0; i < iterations; i++)
+		sSink += watch.Lap();
+	report("Lap()", iterations, system_time() - start);
+
+	start = system_time();
+	for (int32 i = 0; i < iterations; i++) {
+		watch.Suspend();
+		watch.Resume();
+	}
+	report("Suspend() + Resume()", iterations, system_time() - start);
+
+	start = system_time();
+	for (int32 i = 0; i < iterations; i++)
+		watch.Reset();
+	report("Reset()", iterations, system_time() - start);
+}
+
+
+struct thread_data {
+	sem_id		start;
+	int32		iterations;
+};
+
+
+static status_t
+time_section(void* _data)
+{
+	thread_data* data = (thread_data*)_data;
+
+	if (acquire_sem(data->start) != B_OK)
+		return B_ERROR;
+
+	// Keep the sum thread local, a shared sink would bounce between cores
+	bigtime_t sum = 0;
+	for (int32 i = 0; i < data->iterations; i++) {
+		BStopWatch watch("section", true);
+		sum += watch.ElapsedTime();
+	}
+
+	atomic_add64(&sThreadSink, sum);
+	return B_OK;
+}
+
+
+static void
+benchmark_threads(int32 iterations)
+{
+	// Every thread times the same section with its own stop watch
+	thread_data data;
+	data.iterations = iterations / kThreadCount;
+	if (data.iterations == 0)
+		data.iterations = 1;
+
+	data.start = create_sem(0, "stop watch benchmark start");
+	if (data.start < 0) {
+		fprintf(stderr, "could not create semaphore: %s\n", strerror(data.start));
+		exit(1);
+	}
+
+	// Have all threads running and waiting before the clock starts
+	thread_id threads[kThreadCount];
+	for (int32 i = 0; i < kThreadCount; i++) {
+		threads[i] = spawn_thread(time_section, "stop watch benchmark",
+			B_NORMAL_PRIORITY, &data);
+		if (threads[i] < 0) {
+			fprintf(stderr, "could not spawn thread: %s\n", strerror(threads[i]));
+			exit(1);
+		}
+	}
+	for (int32 i = 0; i < kThreadCount; i++)
+		resume_thread(threads[i]);
+
+	bigtime_t start = system_time();
+	release_sem_etc(data.start, kThreadCount, 0);
+
+	for (int32 i = 0; i < kThreadCount; i++) {
+		status_t result;
+		wait_for_thread(threads[i], &result);
+	}
+	bigtime_t elapsed = system_time() - start;
+
+	delete_sem(data.start);
+
+	// Report what one call costs each thread (wall time over its own
+	// iterations), so the row compares directly with "construct + destruct"
+	char label[64];
+	snprintf(label, sizeof(label), "%" B_PRId32 " threads, per thread",
+		kThreadCount);
+	report(label, data.iterations, elapsed);
+}
+
+
+int
+main(int argc, char** argv)
+{
+	int32 iterations = 1000000;
+	if (argc > 1)
+		iterations = atol(argv[1]);
+	if (iterations <= 0) {
+		fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+		return 1;
+	}
+
+	benchmark_calls(iterations);
+	benchmark_threads(iterations);
+	return 0;
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2026, Haiku, Inc. All Rights Reserved.
+ * Distributed under the terms of the MIT License.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <OS.h>
+#include <String.h>
+#include <StringList.h>
+
+
+static const char* kCsvLine
+	= "1042,2026-10-16T02:49:23Z,GET,/api/v1/users,200,5120,0.0042,Mozilla/5.0\n";
+static const char* kHeaderLine
+	= "Accept-Encoding: gzip, deflate, br\r\n";
+
+
+static void
+report(const char* name, int64 tokens, int64 bytes, bigtime_t elapsed)
+{
+	printf("%-28s %12" B_PRId64 " tokens %10.1f MB %10.1f MB/s\n", name,
+		tokens, bytes / 1048576.0,
+		elapsed > 0 ? bytes / 1048576.0 / (elapsed / 1000000.0) : 0.0);
+}
+
+
+static void
+fill_buffer(BString& buffer, const char* line, int64 size)
+{
+	while (buffer.Length() < size)
+		buffer << line;
+}
+
+
+static void
+benchmark_csv(int64 size)
+{
+	BString buffer;
+	fill_buffer(buffer, kCsvLine, size);
+
+	BStringList lines;
+	bigtime_t start = system_time();
+	buffer.Split("\n", true, lines);
+	report("split CSV lines", lines.CountStrings(), buffer.Length(),
+		system_time() - start);
+
+	// Split() appends to the list it is given, so empty it for every line
+	int64 fields = 0;
+	BStringList lineFields;
+	start = system_time();
+	for (int32 i = 0; i < lines.CountStrings(); i++) {
+		lineFields.MakeEmpty();
+		lines.StringAt(i).Split(",", false, lineFields);
+		fields += lineFields.CountStrings();
+	}
+	report("split CSV fields", fields, buffer.Length() - lines.CountStrings(),
+		system_time() - start);
+}
+
+
+static void
+benchmark_headers(int64 size)
+{
+	BString buffer;
+	fill_buffer(buffer, kHeaderLine, size);
+
+	BStringList lines;
+	bigtime_t start = system_time();
+	buffer.Split("\r\n", true, lines);
+	report("split header lines (CRLF)", lines.CountStrings(), buffer.Length(),
+		system_time() - start);
+}
+
+
+int
+main(int argc, char** argv)
+{
+	// The default keeps a run short; pass 1024 for a 1 GB input.
+	int64 megabytes = 64;
+	if (argc > 1)
+		megabytes = atoll(argv[1]);
+	if (megabytes <= 0 || megabytes > 1536) {
+		fprintf(stderr, "usage: %s [input size in MB, up to 1536]\n", argv[0]);
+		return 1;
+	}
+
+	benchmark_csv(megabytes * 1048576);
+	benchmark_headers(megabytes * 1048576);
+	return 0;
+}
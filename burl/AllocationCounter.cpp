@@ -0,0 +1,160 @@
+/*
+ * Copyright 2026, Haiku, Inc. All Rights Reserved.
+ * Distributed under the terms of the MIT License.
+ */
+
+
+/*!	Counts the heap allocations of the whole process.
+
+	Linking this file into an executable interposes malloc(), calloc(),
+	realloc() and free(): the executable comes first in the symbol lookup
+	order, so the calls made from libbe, libstdc++ (operator new) and libroot
+	itself bind to these definitions. Each one forwards to the next definition
+	found via dlsym(RTLD_NEXT), which is libroot's allocator.
+
+	Do not link it into sanitizer or libFuzzer builds, those install their own
+	allocator hooks.
+*/
+
+
+#include "AllocationCounter.h"
+
+#include <dlfcn.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <OS.h>
+
+
+typedef void* (*malloc_function)(size_t size);
+typedef void* (*calloc_function)(size_t count, size_t size);
+typedef void* (*realloc_function)(void* address, size_t size);
+typedef void (*free_function)(void* address);
+
+static malloc_function sMalloc;
+static calloc_function sCalloc;
+static realloc_function sRealloc;
+static free_function sFree;
+
+static int64 sAllocationCount;
+
+// dlsym() may allocate while the real functions are being looked up; those
+// requests are served from here and never given back.
+static char sBootstrapHeap[4096] __attribute__((aligned(16)));
+static size_t sBootstrapUsed;
+static bool sResolving;
+
+
+static void*
+bootstrap_allocate(size_t size)
+{
+	size = (size + 15) & ~(size_t)15;
+	if (size > sizeof(sBootstrapHeap) - sBootstrapUsed)
+		return NULL;
+
+	void* address = sBootstrapHeap + sBootstrapUsed;
+	sBootstrapUsed += size;
+	return address;
+}
+
+
+static bool
+is_bootstrap_allocation(void* address)
+{
+	return (char*)address >= sBootstrapHeap
+		&& (char*)address < sBootstrapHeap + sizeof(sBootstrapHeap);
+}
+
+
+static void
+resolve_allocator()
+{
+	sResolving = true;
+	sMalloc = (malloc_function)dlsym(RTLD_NEXT, "malloc");
+	sCalloc = (calloc_function)dlsym(RTLD_NEXT, "calloc");
+	sRealloc = (realloc_function)dlsym(RTLD_NEXT, "realloc");
+	sFree = (free_function)dlsym(RTLD_NEXT, "free");
+	sResolving = false;
+
+	if (sMalloc == NULL || sCalloc == NULL || sRealloc == NULL
+		|| sFree == NULL) {
+		static const char kMessage[]
+			= "AllocationCounter: could not find the next allocator\n";
+		write(STDERR_FILENO, kMessage, sizeof(kMessage) - 1);
+		abort();
+	}
+}
+
+
+int64
+allocation_count()
+{
+	return atomic_get64(&sAllocationCount);
+}
+
+
+extern "C" void*
+malloc(size_t size)
+{
+	if (sMalloc == NULL) {
+		if (sResolving)
+			return bootstrap_allocate(size);
+		resolve_allocator();
+	}
+
+	atomic_add64(&sAllocationCount, 1);
+	return sMalloc(size);
+}
+
+
+extern "C" void*
+calloc(size_t count, size_t size)
+{
+	if (sCalloc == NULL) {
+		if (sResolving) {
+			// the bootstrap heap is static and never reused, so it is zeroed
+			if (size != 0 && count > ~(size_t)0 / size)
+				return NULL;
+			return bootstrap_allocate(count * size);
+		}
+		resolve_allocator();
+	}
+
+	atomic_add64(&sAllocationCount, 1);
+	return sCalloc(count, size);
+}
+
+
+extern "C" void*
+realloc(void* address, size_t size)
+{
+	if (is_bootstrap_allocation(address)) {
+		void* newAddress = malloc(size);
+		if (newAddress != NULL) {
+			size_t available = sBootstrapHeap + sizeof(sBootstrapHeap)
+				- (char*)address;
+			memcpy(newAddress, address, size < available ? size : available);
+		}
+		return newAddress;
+	}
+
+	if (sRealloc == NULL)
+		resolve_allocator();
+
+	atomic_add64(&sAllocationCount, 1);
+	return sRealloc(address, size);
+}
+
+
+extern "C" void
+free(void* address)
+{
+	if (address == NULL || is_bootstrap_allocation(address))
+		return;
+
+	if (sFree == NULL)
+		resolve_allocator();
+
+	sFree(address);
+}
@@ -0,0 +1,15 @@
+/*
+ * Copyright 2026, Haiku, Inc. All Rights Reserved.
+ * Distributed under the terms of the MIT License.
+ */
+#ifndef _ALLOCATION_COUNTER_H_
+#define _ALLOCATION_COUNTER_H_
+
+
+#include <SupportDefs.h>
+
+
+int64 allocation_count();
+
+
+#endif // _ALLOCATION_COUNTER_H_